@@ -287,7 +287,9 @@ bool cs_register_variables(const struct ConfigSet *cs, struct ConfigDef vars[],
 
   for (size_t i = 0; vars[i].name; i++)
   {
-    vars[i].type |= flags;
+    // Don't dirty the (often flag-less) static tables unnecessarily
+    if (flags != DT_NO_FLAGS)
+      vars[i].type |= flags;
     if (!cs_register_variable(cs, &vars[i], &err))
     {
       mutt_debug(LL_DEBUG1, "%s\n", buf_string(&err));
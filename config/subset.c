@@ -186,11 +186,12 @@ struct HashElem *cs_subset_lookup(const struct ConfigSubset *sub, const char *na
   if (!sub || !name)
     return NULL;
 
-  char scope[256] = { 0 };
-  if (sub->name)
-    snprintf(scope, sizeof(scope), "%s:%s", sub->name, name);
-  else
-    mutt_str_copy(scope, name, sizeof(scope));
+  // The root Subset has no scope prefix, so the name can be used as-is
+  if (!sub->name)
+    return cs_get_elem(sub->cs, name);
+
+  char scope[256];
+  snprintf(scope, sizeof(scope), "%s:%s", sub->name, name);
 
   return cs_get_elem(sub->cs, scope);
 }
@@ -74,6 +74,7 @@ static void hcache_free(struct HeaderCache **ptr)
 
   struct HeaderCache *hc = *ptr;
   FREE(&hc->folder);
+  FREE(&hc->scratch);
 
   FREE(ptr);
 }
@@ -190,13 +191,19 @@ static inline void email_unpack_timezone(struct Email *e, uint32_t packed)
  *
  * This function transforms an Email into a binary string so that it can be
  * saved to a database.
+ *
+ * @note The blob lives in HeaderCache::scratch, which is reused by the next
+ *       call - bulk stores serialise thousands of Emails without a
+ *       malloc/free per record.
  */
 static void *dump_email(struct HeaderCache *hc, const struct Email *e, int *off, uint32_t uidvalidity)
 {
   bool convert = !CharsetIsUtf8;
 
   *off = 0;
-  unsigned char *d = mutt_mem_malloc(4096);
+  if (!hc->scratch)
+    hc->scratch = mutt_mem_malloc(4096);
+  unsigned char *d = hc->scratch;
 
   d = serial_dump_uint32_t((uidvalidity != 0) ? uidvalidity : mutt_date_now(), d, off);
   d = serial_dump_int(hc->crc, d, off);
@@ -220,6 +227,7 @@ static void *dump_email(struct HeaderCache *hc, const struct Email *e, int *off,
   d = serial_dump_body(e->body, d, off, convert);
   d = serial_dump_tags(&e->tags, d, off);
 
+  hc->scratch = d; // The serialisers may have realloc'd the buffer
   return d;
 }
 
@@ -433,10 +441,10 @@ static void *fetch_raw(struct HeaderCache *hc, const char *key, size_t keylen, s
   if (!hc)
     return NULL;
 
-  struct Buffer path = buf_make(1024);
-  keylen = buf_printf(&path, "%s%.*s", hc->folder, (int) keylen, key);
-  void *blob = hc->store_ops->fetch(hc->store_handle, buf_string(&path), keylen, dlen);
-  buf_dealloc(&path);
+  struct Buffer *path = buf_pool_get();
+  keylen = buf_printf(path, "%s%.*s", hc->folder, (int) keylen, key);
+  void *blob = hc->store_ops->fetch(hc->store_handle, buf_string(path), keylen, dlen);
+  buf_pool_release(&path);
   return blob;
 }
 
@@ -690,9 +698,11 @@ int hcache_store(struct HeaderCache *hc, const char *key, size_t keylen,
     return -1;
 
   int dlen = 0;
+  // Points into hc->scratch, which must not be freed here
   char *data = dump_email(hc, e, &dlen, uidvalidity);
 
 #ifdef USE_HCACHE_COMPRESSION
+  char *whole = NULL;
   if (hc->compr_ops)
   {
     /* We don't compress uidvalidity and the crc, so we can check them before
@@ -703,17 +713,12 @@ int hcache_store(struct HeaderCache *hc, const char *key, size_t keylen,
     size_t clen = dlen;
     void *cdata = hc->compr_ops->compress(hc->compr_handle, data + hlen, dlen - hlen, &clen);
     if (!cdata)
-    {
-      FREE(&data);
       return -1;
-    }
 
-    char *whole = mutt_mem_malloc(hlen + clen);
+    whole = mutt_mem_malloc(hlen + clen);
     memcpy(whole, data, hlen);
     memcpy(whole + hlen, cdata, clen);
 
-    FREE(&data);
-
     data = whole;
     dlen = hlen + clen;
   }
@@ -723,7 +728,9 @@ int hcache_store(struct HeaderCache *hc, const char *key, size_t keylen,
   struct RealKey *rk = realkey(hc, key, keylen);
   int rc = hcache_store_raw(hc, rk->key, rk->len, data, dlen);
 
-  FREE(&data);
+#ifdef USE_HCACHE_COMPRESSION
+  FREE(&whole);
+#endif
 
   return rc;
 }
@@ -744,11 +751,11 @@ int hcache_store_raw(struct HeaderCache *hc, const char *key, size_t keylen,
   if (!hc)
     return -1;
 
-  struct Buffer path = buf_make(1024);
+  struct Buffer *path = buf_pool_get();
 
-  keylen = buf_printf(&path, "%s%.*s", hc->folder, (int) keylen, key);
-  int rc = hc->store_ops->store(hc->store_handle, buf_string(&path), keylen, data, dlen);
-  buf_dealloc(&path);
+  keylen = buf_printf(path, "%s%.*s", hc->folder, (int) keylen, key);
+  int rc = hc->store_ops->store(hc->store_handle, buf_string(path), keylen, data, dlen);
+  buf_pool_release(&path);
 
   return rc;
 }
@@ -761,11 +768,11 @@ int hcache_delete_record(struct HeaderCache *hc, const char *key, size_t keylen)
   if (!hc)
     return -1;
 
-  struct Buffer path = buf_make(1024);
+  struct Buffer *path = buf_pool_get();
 
-  keylen = buf_printf(&path, "%s%s", hc->folder, key);
+  keylen = buf_printf(path, "%s%s", hc->folder, key);
 
-  int rc = hc->store_ops->delete_record(hc->store_handle, buf_string(&path), keylen);
-  buf_dealloc(&path);
+  int rc = hc->store_ops->delete_record(hc->store_handle, buf_string(path), keylen);
+  buf_pool_release(&path);
   return rc;
 }
@@ -92,6 +92,7 @@ struct HeaderCache
   StoreHandle *store_handle;          ///< Store handle
   const struct ComprOps *compr_ops;   ///< Compression backend
   ComprHandle *compr_handle;          ///< Compression handle
+  void *scratch;                      ///< Serialisation buffer, reused across stores
 };
 
 /**
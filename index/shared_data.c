@@ -35,51 +35,67 @@
 #include "lib.h"
 #include "mview.h"
 
+/// A pool of unused IndexSharedData, recycled by index_shared_data_new()
+static struct IndexSharedData *SharedDataPool[4] = { 0 };
+/// Number of IndexSharedData in the pool
+static size_t SharedDataPoolCount = 0;
+
 /**
- * index_shared_data_set_mview - Set the MailboxView for the Index and friends
- * @param shared Shared Index data
- * @param mv     Mailbox View, may be NULL
+ * shared_data_apply - Update the shared data and notify listeners once
+ * @param shared    Shared Index data
+ * @param mv        Mailbox View, may be NULL
+ * @param e         Current Email, may be NULL (unused if !set_email)
+ * @param set_email If true, set the current Email to @a e
+ *
+ * Accumulate all the changes into one #NotifyIndex bitmask, so the listeners
+ * are walked once, however many fields have changed.
+ *
+ * If @a set_email is false, the current Email is left alone unless the
+ * Mailbox changes, in which case it's dropped.  IndexSharedData::email may be
+ * dangling (e.g. after mx_mbox_close() freed the Emails of a Mailbox that's
+ * being re-opened), so it must never be dereferenced - only @a e, which the
+ * caller guarantees is live when @a set_email is set.
  */
-void index_shared_data_set_mview(struct IndexSharedData *shared, struct MailboxView *mv)
+static void shared_data_apply(struct IndexSharedData *shared, struct MailboxView *mv,
+                              struct Email *e, bool set_email)
 {
-  if (!shared)
-    return;
-
   NotifyIndex subtype = NT_INDEX_NO_FLAGS;
 
-  if (shared->mailbox_view != mv)
-  {
-    shared->mailbox_view = mv;
-    subtype |= NT_INDEX_MVIEW;
-  }
+  /* Assigning an unchanged value is free, so assign unconditionally and use
+   * the comparison only to accumulate the subtype mask - the compiler can
+   * turn these into branch-free code. */
+  subtype |= (shared->mailbox_view != mv) ? NT_INDEX_MVIEW : NT_INDEX_NO_FLAGS;
+  shared->mailbox_view = mv;
 
   struct Mailbox *m = mview_mailbox(mv);
   if (shared->mailbox != m)
   {
+    // Not branchless: changing Mailbox has the side effect of dropping the Email
     shared->mailbox = m;
-    shared->email = NULL;
-    shared->email_seq = 0;
+    e = NULL;
+    set_email = true;
     subtype |= NT_INDEX_MAILBOX | NT_INDEX_EMAIL;
   }
 
   struct Account *a = m ? m->account : NULL;
-  if (shared->account != a)
-  {
-    shared->account = a;
-    subtype |= NT_INDEX_ACCOUNT;
-  }
+  subtype |= (shared->account != a) ? NT_INDEX_ACCOUNT : NT_INDEX_NO_FLAGS;
+  shared->account = a;
 
-  struct ConfigSubset *sub = NeoMutt->sub;
-#if 0
-  if (m)
-    sub = m->sub;
-  else if (a)
-    sub = a->sub;
-#endif
-  if (shared->sub != sub)
+  /* IndexSharedData::sub is fixed at construction: NeoMutt->sub is created
+   * once at startup and never replaced, so chasing the global pointer here
+   * could never find a change.  If per-Mailbox/Account ConfigSubsets are ever
+   * enabled, this is where they'd be picked, e.g.
+   * sub = m ? m->sub : (a ? a->sub : NeoMutt->sub), sending NT_INDEX_SUBSET
+   * when it differs. */
+
+  if (set_email)
   {
-    shared->sub = sub;
-    subtype |= NT_INDEX_SUBSET;
+    size_t seq = e ? e->sequence : 0;
+    subtype |= ((shared->email != e) || (shared->email_seq != seq)) ?
+                   NT_INDEX_EMAIL :
+                   NT_INDEX_NO_FLAGS;
+    shared->email = e;
+    shared->email_seq = seq;
   }
 
   if (subtype != NT_INDEX_NO_FLAGS)
@@ -90,40 +106,29 @@ void index_shared_data_set_mview(struct IndexSharedData *shared, struct MailboxV
 }
 
 /**
- * index_shared_data_set_email - Set the current Email for the Index and friends
+ * index_shared_data_set_mview - Set the MailboxView for the Index and friends
  * @param shared Shared Index data
- * @param e      Current Email, may be NULL
+ * @param mv     Mailbox View, may be NULL
  */
-void index_shared_data_set_email(struct IndexSharedData *shared, struct Email *e)
+void index_shared_data_set_mview(struct IndexSharedData *shared, struct MailboxView *mv)
 {
   if (!shared)
     return;
 
-  size_t seq = e ? e->sequence : 0;
-  if ((shared->email != e) || (shared->email_seq != seq))
-  {
-    shared->email = e;
-    shared->email_seq = seq;
-
-    mutt_debug(LL_NOTIFY, "NT_INDEX_EMAIL: %p\n", (void *) shared->email);
-    notify_send(shared->notify, NT_INDEX, NT_INDEX_EMAIL, shared);
-  }
+  shared_data_apply(shared, mv, NULL, false);
 }
 
 /**
- * index_shared_data_is_cur_email - Check whether an email is the currently selected Email
+ * index_shared_data_set_email - Set the current Email for the Index and friends
  * @param shared Shared Index data
- * @param e      Email to check
- * @retval true  e is current
- * @retval false e is not current
+ * @param e      Current Email, may be NULL
  */
-bool index_shared_data_is_cur_email(const struct IndexSharedData *shared,
-                                    const struct Email *e)
+void index_shared_data_set_email(struct IndexSharedData *shared, struct Email *e)
 {
   if (!shared)
-    return false;
+    return;
 
-  return shared->email_seq == e->sequence;
+  shared_data_apply(shared, shared->mailbox_view, e, true);
 }
 
 /**
@@ -142,7 +147,15 @@ void index_shared_data_free(struct MuttWindow *win, void **ptr)
   notify_send(shared->notify, NT_INDEX, NT_INDEX_DELETE, shared);
   notify_free(&shared->notify);
 
-  FREE(ptr);
+  if (SharedDataPoolCount < mutt_array_size(SharedDataPool))
+  {
+    SharedDataPool[SharedDataPoolCount++] = shared;
+    *ptr = NULL;
+  }
+  else
+  {
+    FREE(ptr);
+  }
 }
 
 /**
@@ -151,13 +164,33 @@ void index_shared_data_free(struct MuttWindow *win, void **ptr)
  */
 struct IndexSharedData *index_shared_data_new(void)
 {
-  struct IndexSharedData *shared = mutt_mem_calloc(1, sizeof(struct IndexSharedData));
+  struct IndexSharedData *shared = NULL;
 
-  shared->notify = notify_new();
+  if (SharedDataPoolCount > 0)
+    shared = SharedDataPool[--SharedDataPoolCount];
+  else
+    shared = mutt_mem_malloc(sizeof(struct IndexSharedData));
+
+  // Initialise every field explicitly, rather than zeroing the whole struct
   shared->sub = NeoMutt->sub;
+  shared->account = NULL;
+  shared->mailbox_view = NULL;
+  shared->mailbox = NULL;
+  shared->email = NULL;
+  shared->email_seq = 0;
+  shared->notify = notify_new();
 
   mutt_debug(LL_NOTIFY, "NT_INDEX_ADD: %p\n", (void *) shared);
   notify_send(shared->notify, NT_INDEX, NT_INDEX_ADD, shared);
 
   return shared;
 }
+
+/**
+ * index_shared_data_cleanup - Release the IndexSharedData pool
+ */
+void index_shared_data_cleanup(void)
+{
+  while (SharedDataPoolCount)
+    FREE(&SharedDataPool[--SharedDataPoolCount]);
+}
@@ -25,9 +25,9 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include "email/email.h"
 
 struct MailboxView;
-struct Email;
 struct MuttWindow;
 
 /**
@@ -44,11 +44,30 @@ struct IndexSharedData
   struct Notify       *notify;         ///< Notifications: #NotifyIndex, #IndexSharedData
 };
 
+void                    index_shared_data_cleanup(void);
 void                    index_shared_data_free(struct MuttWindow *win, void **ptr);
 struct IndexSharedData *index_shared_data_new (void);
 
-bool index_shared_data_is_cur_email(const struct IndexSharedData *shared, const struct Email *e);
 void index_shared_data_set_mview   (struct IndexSharedData *shared, struct MailboxView *mv);
 void index_shared_data_set_email   (struct IndexSharedData *shared, struct Email *e);
 
+/**
+ * index_shared_data_is_cur_email - Check whether an email is the currently selected Email
+ * @param shared Shared Index data
+ * @param e      Email to check
+ * @retval true  e is current
+ * @retval false e is not current
+ *
+ * Called for every row of an Index redraw, so it's inlined here to avoid a
+ * function call per row.
+ */
+static inline bool index_shared_data_is_cur_email(const struct IndexSharedData *shared,
+                                                  const struct Email *e)
+{
+  if (!shared)
+    return false;
+
+  return shared->email_seq == e->sequence;
+}
+
 #endif /* MUTT_INDEX_SHARED_DATA_H */
@@ -30,9 +30,9 @@
 #include <stddef.h>
 #include <config/lib.h>
 #include <ctype.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <string.h>
 #include "mutt/lib.h"
 
 /**
@@ -46,22 +46,24 @@ static int maildir_field_delimiter_validator(const struct ConfigSet *cs,
 {
   const char *delim = (const char *) value;
 
-  if (strlen(delim) != 1)
+  // Exactly one character, without walking the whole string
+  if ((delim[0] == '\0') || (delim[1] != '\0'))
   {
     // L10N: maildir_field_delimiter is a config variable and shouldn't be translated
     buf_printf(err, _("maildir_field_delimiter must be exactly one character long"));
     return CSR_ERR_INVALID;
   }
 
-  if (isalnum(*delim) || strchr("-.\\/", *delim))
+  if (isalnum(*delim) || (*delim == '-') || (*delim == '.') ||
+      (*delim == '\\') || (*delim == '/'))
   {
     // L10N: maildir_field_delimiter is a config variable and shouldn't be translated
     buf_printf(err, _("maildir_field_delimiter cannot be alphanumeric or '-.\\/'"));
     return CSR_ERR_INVALID;
   }
 
-  static bool maildir_field_delimiter_changed = false;
-  if (maildir_field_delimiter_changed)
+  static atomic_bool maildir_field_delimiter_changed = false;
+  if (atomic_load_explicit(&maildir_field_delimiter_changed, memory_order_relaxed))
   {
     // L10N: maildir_field_delimiter is a config variable and shouldn't be translated
     buf_printf(err, _("maildir_field_delimiter can only be set once"));
@@ -70,7 +72,7 @@ static int maildir_field_delimiter_validator(const struct ConfigSet *cs,
 
   if (*delim != *(const char *) cdef->initial)
   {
-    maildir_field_delimiter_changed = true;
+    atomic_store_explicit(&maildir_field_delimiter_changed, true, memory_order_release);
   }
 
   return CSR_SUCCESS;
@@ -1400,6 +1400,7 @@ main_exit:
   mutt_list_free(&queries);
   crypto_module_cleanup();
   rootwin_cleanup();
+  index_shared_data_cleanup();
   buf_pool_cleanup();
   envlist_free(&EnvList);
   mutt_browser_cleanup();
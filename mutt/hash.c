@@ -60,6 +60,9 @@ static size_t gen_string_hash(union HashKey key, size_t num_elems)
  */
 static int cmp_string_key(union HashKey a, union HashKey b)
 {
+  // Merged string literals (e.g. config names) often share a pointer
+  if (a.strkey == b.strkey)
+    return 0;
   return mutt_str_cmp(a.strkey, b.strkey);
 }
 
@@ -87,6 +90,8 @@ static size_t gen_case_string_hash(union HashKey key, size_t num_elems)
  */
 static int cmp_case_string_key(union HashKey a, union HashKey b)
 {
+  if (a.strkey == b.strkey)
+    return 0;
   return mutt_istr_cmp(a.strkey, b.strkey);
 }
 
@@ -131,6 +131,10 @@ static bool send(struct Notify *source, struct Notify *current,
 
     if ((o->type == NT_ALL) || (event_type == o->type))
     {
+      // Skip Observers that don't care about any of this event's subtype bits
+      if ((o->mask != 0) && ((event_subtype & o->mask) == 0))
+        continue;
+
       struct NotifyCallback nc = { current, event_type, event_subtype,
                                    event_data, o->global_data };
       if (o->callback(&nc) < 0)
@@ -176,18 +180,23 @@ bool notify_send(struct Notify *notify, enum NotifyType event_type,
 }
 
 /**
- * notify_observer_add - Add an observer to an object
+ * notify_observer_add_mask - Add an observer of selected event subtypes to an object
  * @param notify      Notification handler
  * @param type        Notification type to observe, e.g. #NT_WINDOW
+ * @param mask        Bitmask of event subtypes to deliver, 0 for all
  * @param callback    Function to call on a matching event, see ::observer_t
  * @param global_data Private data associated with the observer
  * @retval true Successful
  *
  * New observers are added to the front of the list, giving them higher
  * priority than existing observers.
+ *
+ * @note The mask is only useful for events whose subtypes are flags, e.g.
+ *       #NotifyIndex.  For enumerated subtypes, pass 0 and filter in the
+ *       callback.
  */
-bool notify_observer_add(struct Notify *notify, enum NotifyType type,
-                         observer_t callback, void *global_data)
+bool notify_observer_add_mask(struct Notify *notify, enum NotifyType type,
+                              int mask, observer_t callback, void *global_data)
 {
   if (!notify || !callback)
     return false;
@@ -204,6 +213,7 @@ bool notify_observer_add(struct Notify *notify, enum NotifyType type,
 
   struct Observer *o = mutt_mem_calloc(1, sizeof(*o));
   o->type = type;
+  o->mask = mask;
   o->callback = callback;
   o->global_data = global_data;
 
@@ -214,6 +224,22 @@ bool notify_observer_add(struct Notify *notify, enum NotifyType type,
   return true;
 }
 
+/**
+ * notify_observer_add - Add an observer to an object
+ * @param notify      Notification handler
+ * @param type        Notification type to observe, e.g. #NT_WINDOW
+ * @param callback    Function to call on a matching event, see ::observer_t
+ * @param global_data Private data associated with the observer
+ * @retval true Successful
+ *
+ * The observer will see every subtype of the chosen event type.
+ */
+bool notify_observer_add(struct Notify *notify, enum NotifyType type,
+                         observer_t callback, void *global_data)
+{
+  return notify_observer_add_mask(notify, type, 0, callback, global_data);
+}
+
 /**
  * notify_observer_remove - Remove an observer from an object
  * @param notify      Notification handler
@@ -35,6 +35,7 @@ void notify_set_parent(struct Notify *notify, struct Notify *parent);
 
 bool notify_send(struct Notify *notify, enum NotifyType event_type, int event_subtype, void *event_data);
 bool notify_observer_add(struct Notify *notify, enum NotifyType type, observer_t callback, void *global_data);
+bool notify_observer_add_mask(struct Notify *notify, enum NotifyType type, int mask, observer_t callback, void *global_data);
 bool notify_observer_remove(struct Notify *notify, const observer_t callback, const void *global_data);
 void notify_observer_remove_all(struct Notify *notify);
 
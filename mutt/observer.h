@@ -59,6 +59,7 @@ typedef int (*observer_t)(struct NotifyCallback *nc);
 struct Observer
 {
   enum NotifyType type;  ///< Notification type to observe, e.g. #NT_WINDOW
+  int mask;              ///< Bitmask of event subtypes to deliver, 0 for all
   observer_t callback;   ///< Callback function for events
   void *global_data;     ///< Private data to pass to callback
 };
@@ -37,6 +37,14 @@
 #include "mutt/lib.h"
 #include "lib.h"
 
+/// Database page size
+/// Larger pages mean fewer bucket splits and fewer reads per fetch for
+/// typical multi-KB header records
+static const int GdbmPageSize = 32768;
+
+/// Number of buckets to keep in gdbm's internal cache
+static const size_t GdbmCacheSize = 1024;
+
 /**
  * store_gdbm_open - Implements StoreOps::open() - @ingroup store_open
  */
@@ -45,13 +53,18 @@ static StoreHandle *store_gdbm_open(const char *path)
   if (!path)
     return NULL;
 
-  const int pagesize = 4096;
+  GDBM_FILE db = gdbm_open((char *) path, GdbmPageSize, GDBM_WRCREAT, 00600, NULL);
+  if (!db && ((gdbm_errno == GDBM_FILE_OPEN_ERROR) || (gdbm_errno == GDBM_CANT_BE_WRITER)))
+  {
+    /* if rw failed due to a permission/writer problem, try ro;
+     * other errors (e.g. a corrupt file) won't be fixed by retrying */
+    db = gdbm_open((char *) path, GdbmPageSize, GDBM_READER, 00600, NULL);
+  }
 
-  GDBM_FILE db = gdbm_open((char *) path, pagesize, GDBM_WRCREAT, 00600, NULL);
-  if (!db)
+  if (db)
   {
-    /* if rw failed try ro */
-    db = gdbm_open((char *) path, pagesize, GDBM_READER, 00600, NULL);
+    size_t size = GdbmCacheSize;
+    gdbm_setopt(db, GDBM_SETCACHESIZE, &size, sizeof(size));
   }
 
   // Return an opaque pointer
@@ -66,15 +79,15 @@ static void *store_gdbm_fetch(StoreHandle *store, const char *key, size_t klen,
   if (!store || (klen > INT_MAX))
     return NULL;
 
-  datum dkey = { 0 };
-  datum data = { 0 };
-
   // Decloak an opaque pointer
   GDBM_FILE db = store;
 
+  // Every field is assigned, so skip the zero-init
+  datum dkey;
   dkey.dptr = (char *) key;
   dkey.dsize = klen;
-  data = gdbm_fetch(db, dkey);
+
+  datum data = gdbm_fetch(db, dkey);
 
   *vlen = data.dsize;
   return data.dptr;
@@ -97,15 +110,14 @@ static int store_gdbm_store(StoreHandle *store, const char *key, size_t klen,
   if (!store || (klen > INT_MAX) || (vlen > INT_MAX))
     return -1;
 
-  datum dkey = { 0 };
-  datum databuf = { 0 };
-
   // Decloak an opaque pointer
   GDBM_FILE db = store;
 
+  datum dkey;
   dkey.dptr = (char *) key;
   dkey.dsize = klen;
 
+  datum databuf;
   databuf.dsize = vlen;
   databuf.dptr = value;
 
@@ -120,11 +132,10 @@ static int store_gdbm_delete_record(StoreHandle *store, const char *key, size_t
   if (!store || (klen > INT_MAX))
     return -1;
 
-  datum dkey = { 0 };
-
   // Decloak an opaque pointer
   GDBM_FILE db = store;
 
+  datum dkey;
   dkey.dptr = (char *) key;
   dkey.dsize = klen;
 
@@ -95,6 +95,12 @@ struct StoreOps
    * @param[out] vlen  Length of the Value
    * @retval ptr  Success, Value associated with the Key
    * @retval NULL Error, or Key not found
+   *
+   * The Value may point into backend-owned memory, e.g. LMDB returns a
+   * pointer into its memory-mapped database file rather than a copy.
+   * It is only valid until the matching free(), the next store() or
+   * delete_record() through the same handle, or close(), whichever comes
+   * first.
    */
   void *(*fetch)(StoreHandle *store, const char *key, size_t klen, size_t *vlen);
 
@@ -105,6 +111,10 @@ struct StoreOps
    * free - Free a Value returned by fetch()
    * @param[in]  store Store retrieved via open()
    * @param[out] ptr   Value to be freed
+   *
+   * This is the release half of fetch().  Backends that hand out copies
+   * (gdbm, bdb, ...) free the copy here; zero-copy backends (lmdb) treat
+   * this as a no-op because the data belongs to the database.
    */
   void (*free)(StoreHandle *store, void **ptr);
 
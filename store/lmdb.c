@@ -202,6 +202,10 @@ fail_env:
 
 /**
  * store_lmdb_fetch - Implements StoreOps::fetch() - @ingroup store_fetch
+ *
+ * This is zero-copy: mdb_get() returns a pointer into the mmap'd database
+ * file, so there's no malloc()/memcpy() per record.  The pointer stays valid
+ * while the read transaction is live, i.e. until the next write or close.
  */
 static void *store_lmdb_fetch(StoreHandle *store, const char *key, size_t klen, size_t *vlen)
 {